@@ -9,6 +9,9 @@
 #include <limits>			// 输入流清空（numeric_limits）
 #include <unordered_set>
 #include <unordered_map>
+#include <utility>			// move
+#include <fstream>			// 导出、读取文件
+#include <sstream>			// 解析教学班文件
 
 using namespace std;
 
@@ -18,13 +21,48 @@ struct TimeSlot {
 	string startTime;  // 开始时间
 	string endTime;    // 结束时间
 	string location;   // 教学地点
+	int day;           // 星期序号（周一为 0，无法识别为 -1）
+	int startMinute;   // 开始时间，距 0 点的分钟数（无法识别为 -1）
+	int endMinute;     // 结束时间，距 0 点的分钟数（无法识别为 -1）
 	
 	TimeSlot(string weekday, string startTime, string endTime, string location)
-	: weekday(weekday), startTime(startTime), endTime(endTime), location(location) {}
+	: weekday(move(weekday)), startTime(move(startTime)), endTime(move(endTime)), location(move(location)),
+	  day(parseWeekday(this->weekday)), startMinute(parseMinute(this->startTime)), endMinute(parseMinute(this->endTime)) {}
 	
-	// 判断两个时间区间是否冲突
+	// 星期和时间是否都能识别
+	bool isValid() const {
+		return day >= 0 && startMinute >= 0 && endMinute > startMinute;
+	}
+	
+	// 判断两个时间区间是否冲突（比较构造时解析好的整数，不再逐次比较字符串）
 	bool isConflict(const TimeSlot& other) const {
-		return weekday == other.weekday && !(endTime <= other.startTime || startTime >= other.endTime);
+		return day == other.day && startMinute < other.endMinute && other.startMinute < endMinute;
+	}
+	
+	// 解析星期（周一~周日）
+	static int parseWeekday(const string& weekday) {
+		static const char* const names[] = {"周一", "周二", "周三", "周四", "周五", "周六", "周日"};
+		for (int i = 0; i < 7; i++) {
+			if (weekday == names[i]) return i;
+		}
+		return -1;
+	}
+	
+	// 解析 "HH:MM" 格式的时间
+	static int parseMinute(const string& time) {
+		size_t colon = time.find(':');
+		if (colon == string::npos || colon == 0 || colon > 2 || colon + 1 == time.size() || time.size() - colon - 1 > 2) {
+			return -1;		// 冒号两侧须为 1~2 位数字，避免累加时溢出
+		}
+		int hour = 0, minute = 0;
+		for (size_t i = 0; i < time.size(); i++) {
+			if (i == colon) continue;
+			if (!isdigit((unsigned char)time[i])) return -1;
+			if (i < colon) hour = hour * 10 + (time[i] - '0');
+			else minute = minute * 10 + (time[i] - '0');
+		}
+		if (hour > 23 || minute > 59) return -1;
+		return hour * 60 + minute;
 	}
 };
 
@@ -36,7 +74,37 @@ struct CourseClass {
 	bool selected;      // 是否被选中
 	
 	CourseClass(string classId, string teacher, TimeSlot timeSlot)
-	: classId(classId), teacher(teacher), timeSlot(timeSlot), selected(false) {}
+	: classId(move(classId)), teacher(move(teacher)), timeSlot(move(timeSlot)), selected(false) {}
+};
+
+// 选课变更类型
+enum class ChangeType {
+	Select,        // 选课
+	Drop,          // 退选（含更换教学班时取消原教学班）
+	CascadeDrop    // 因前置课程被退选而联动退选
+};
+
+// 选课变更事件：按发生顺序记录，供下游查看选课、退选过程
+struct ChangeEvent {
+	ChangeType type;    // 变更类型
+	string courseId;    // 课程编号
+	string classId;     // 教学班编号
+	int credit;         // 变更涉及的学分
+	
+	ChangeEvent(ChangeType type, string courseId, string classId, int credit)
+	: type(type), courseId(move(courseId)), classId(move(classId)), credit(credit) {}
+};
+
+class Course;
+
+// 选课冲突时的替代方案
+struct ClassAlternative {
+	const Course* course;       // 涉及的课程
+	const CourseClass* cls;     // 建议选择的教学班
+	bool isSwap;                // false：改选本课程的该教学班；true：将 course 换到该教学班以腾出时间
+	
+	ClassAlternative(const Course* course, const CourseClass* cls, bool isSwap)
+	: course(course), cls(cls), isSwap(isSwap) {}
 };
 
 // 课程类
@@ -50,16 +118,16 @@ public:
 	vector<CourseClass> classes;    // 该课程下的所有教学班
 	
 	Course(string id, string name, int credit, int semester)
-	: id(id), name(name), credit(credit), semester(semester) {}
+	: id(move(id)), name(move(name)), credit(credit), semester(semester) {}
 	
 	// 添加前置课程
 	void addPrerequisite(Course* prereq) {
 		prerequisites.push_back(prereq);
 	}
 	
-	// 添加教学班
-	void addCourseClass(const CourseClass& courseClass) {
-		classes.push_back(courseClass);
+	// 添加教学班（按值接收，临时对象直接移动进容器，避免字符串拷贝）
+	void addCourseClass(CourseClass courseClass) {
+		classes.push_back(move(courseClass));
 	}
 	
 	// 检查该课程是否有已选中的教学班
@@ -95,6 +163,26 @@ private:
 	vector<Course*> allCourses;				// 存储所有的课程
 	int totalCredits;						// 已选的总学分
 	const int CREDIT_THRESHOLD = 20;		// 学分要求，我写的是20，可以修改的。
+	// 课表的星期和时间段（课表按字符串精确匹配，教学班时间必须落在其中才能显示）
+	const vector<string> TIMETABLE_WEEKDAYS = {"周一", "周二", "周三", "周四", "周五"};
+	const vector<string> TIMETABLE_RANGES = {"08:00-09:00", "09:00-10:00", "10:00-11:00", "14:00-15:00", "16:00-17:00"};
+	vector<ChangeEvent> changeLog;			// 选课变更记录（只追加）
+	
+	// 记录一条选课变更
+	void recordChange(ChangeType type, const Course* course, const CourseClass& cls) {
+		changeLog.emplace_back(type, course->id, cls.classId, course->credit);
+	}
+	
+	// 取消课程的已选教学班，并记录变更
+	void dropSelectedClass(Course* course, ChangeType type) {
+		for (auto& cls : course->classes) {
+			if (cls.selected) {
+				cls.selected = false;
+				totalCredits -= course->credit;
+				recordChange(type, course, cls);
+			}
+		}
+	}
 	
 	// 递归查找所有依赖该课程的已选课程
 	void findDependentCourses(Course* target, vector<Course*>& dependents) {
@@ -111,9 +199,10 @@ private:
 		}
 	}
 	
-	// 检查时间冲突
-	bool isTimeConflict(const TimeSlot& newTimeSlot) const {
+	// 检查时间冲突（ignore 非空时不检查该课程，用于评估换班）
+	bool isTimeConflict(const TimeSlot& newTimeSlot, const Course* ignore = nullptr) const {
 		for (Course* course : allCourses) {
+			if (course == ignore) continue;
 			const CourseClass* selectedClass = course->getSelectedClass();
 			if (selectedClass && selectedClass->timeSlot.isConflict(newTimeSlot)) {
 				return true;
@@ -122,6 +211,99 @@ private:
 		return false;
 	}
 	
+	// 查找与指定时间冲突的已选课程（ignore 非空时不检查该课程）
+	vector<Course*> findConflictingCourses(const TimeSlot& newTimeSlot, const Course* ignore = nullptr) const {
+		vector<Course*> conflicts;
+		for (Course* course : allCourses) {
+			if (course == ignore) continue;
+			const CourseClass* selectedClass = course->getSelectedClass();
+			if (selectedClass && selectedClass->timeSlot.isConflict(newTimeSlot)) {
+				conflicts.push_back(course);
+			}
+		}
+		return conflicts;
+	}
+	
+	// 显示一个教学班的编号、教师、时间和地点
+	void printClassLine(const CourseClass& cls) {
+		cout << "  └─ " << cls.classId << " | " << cls.teacher << " | "
+			 << cls.timeSlot.weekday << " " << cls.timeSlot.startTime << "-"
+			 << cls.timeSlot.endTime << " | " << cls.timeSlot.location << endl;
+	}
+	
+	// 显示冲突时的替代方案（见 findAlternatives），返回是否找到了替代方案
+	bool displayAlternatives(const Course* course, const CourseClass& rejected) {
+		vector<ClassAlternative> alternatives = findAlternatives(course, rejected);
+		bool sameCourseHeader = false, swapHeader = false;
+		for (const ClassAlternative& alt : alternatives) {
+			if (!alt.isSwap && !sameCourseHeader) {
+				setColor(14);
+				cout << "\n可改选本课程的以下教学班：" << endl;
+				setColor(7);
+				sameCourseHeader = true;
+			} else if (alt.isSwap && !swapHeader) {
+				setColor(14);
+				cout << "\n或将【" << alt.course->name << "】换到以下教学班以腾出该时间：" << endl;
+				setColor(7);
+				swapHeader = true;
+			}
+			printClassLine(*alt.cls);
+		}
+		return !alternatives.empty();
+	}
+	
+	// 判断两门课程是否一定冲突：任意两个教学班的组合都时间冲突，即无法同时选修
+	bool isAlwaysConflicting(const Course* a, const Course* b) const {
+		if (a->classes.empty() || b->classes.empty()) return false;
+		for (const auto& x : a->classes) {
+			for (const auto& y : b->classes) {
+				if (!x.timeSlot.isConflict(y.timeSlot)) return false;
+			}
+		}
+		return true;
+	}
+	
+	// CSV 字段转义：含逗号、引号或换行时用引号括起，内部引号写两次
+	static string csvField(const string& field) {
+		if (field.find_first_of(",\"\r\n") == string::npos) return field;
+		string quoted = "\"";
+		for (char ch : field) {
+			if (ch == '"') quoted += '"';
+			quoted += ch;
+		}
+		quoted += '"';
+		return quoted;
+	}
+	
+	// 判断上课时间能否显示在课表中
+	bool fitsTimetable(const TimeSlot& timeSlot) const {
+		string timeRange = timeSlot.startTime + "-" + timeSlot.endTime;
+		return find(TIMETABLE_WEEKDAYS.begin(), TIMETABLE_WEEKDAYS.end(), timeSlot.weekday) != TIMETABLE_WEEKDAYS.end()
+			&& find(TIMETABLE_RANGES.begin(), TIMETABLE_RANGES.end(), timeRange) != TIMETABLE_RANGES.end();
+	}
+	
+	// 按编号查找课程，找不到返回 nullptr
+	const Course* findCourseById(const string& id) const {
+		for (Course* course : allCourses) {
+			if (course->id == id) return course;
+		}
+		return nullptr;
+	}
+	
+	// 联动退选失去前置条件的课程，直到没有新的退选
+	void dropUnsatisfiedCourses() {
+		bool dropped = true;
+		while (dropped) {
+			dropped = false;
+			for (Course* course : allCourses) {
+				if (course->hasSelectedClass() && !course->canSelect(allCourses)) {
+					dropSelectedClass(course, ChangeType::CascadeDrop);
+					dropped = true;
+				}
+			}
+		}
+	}
+	
 	// 设置控制台颜色
 	void setColor(int color) {
 		HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
@@ -328,7 +510,7 @@ public:
 	void displayMenu() {
 		setColor(15);
 		cout << "\n操作菜单：" << endl;
-		cout << "1-16：选择课程 | R：退选课程 | C：学分检查 | D：课程依赖 | T：查询课表 | Q：退出" << endl;
+		cout << "1-16：选择课程 | R：退选课程 | C：学分检查 | D：课程依赖 | T：查询课表 | L：变更记录 | E：导出选课 | U：更新教学班 | Q：退出" << endl;
 		cout << "请输入操作：";
 	}
 	
@@ -391,26 +573,33 @@ public:
 			return;
 		}
 		
-		// 取消该课程其他已选的教学班
+		// 检查时间冲突（本课程原教学班将被替换，不参与检查）
+		if (isTimeConflict(selectedClass.timeSlot, course)) {
+			setColor(12);
+			cout << "时间冲突！该教学班与已选课程上课时间重叠，无法选择！" << endl;
+			setColor(7);
+			if (displayAlternatives(course, selectedClass)) {
+				cout << "\n按任意键返回...";
+				_getch();
+			} else {
+				Sleep(2000);
+			}
+			return;
+		}
+		
+		// 冲突检查通过后，再取消该课程其他已选的教学班
 		for (auto& cls : course->classes) {
 			if (cls.selected) {
 				cls.selected = false;
 				totalCredits -= course->credit;
+				recordChange(ChangeType::Drop, course, cls);
 			}
 		}
 		
-		// 检查时间冲突
-		if (isTimeConflict(selectedClass.timeSlot)) {
-			setColor(12);
-			cout << "时间冲突！该教学班与已选课程上课时间重叠，无法选择！" << endl;
-			setColor(7);
-			Sleep(2000);
-			return;
-		}
-		
 		// 选中该教学班
 		selectedClass.selected = true;
 		totalCredits += course->credit;
+		recordChange(ChangeType::Select, course, selectedClass);
 		
 		setColor(10);
 		cout << "^-^ 成功选择：" << course->name << " - " << selectedClass.classId << endl;
@@ -484,6 +673,7 @@ public:
 				if (cls.selected) {
 					cls.selected = false;
 					totalCredits -= dep->credit;
+					recordChange(ChangeType::CascadeDrop, dep, cls);
 					cout << "@A@ 已退选依赖课程：" << dep->name << " - " << cls.classId << endl;
 				}
 			}
@@ -494,6 +684,7 @@ public:
 			if (cls.selected) {
 				cls.selected = false;
 				totalCredits -= target->credit;
+				recordChange(ChangeType::Drop, target, cls);
 				cout << "@V@ 已成功退选：" << target->name << " - " << cls.classId << endl;
 			}
 		}
@@ -530,6 +721,244 @@ public:
 			for (Course* p : c->prerequisites) cout << p->name << " ";
 			cout << endl;
 		}
+		
+		// 所有教学班组合都冲突的课程对
+		setColor(11);
+		cout << "\n==============================================无法同时选修==============================================" << endl;
+		bool hasPair = false;
+		for (size_t i = 0; i < allCourses.size(); i++) {
+			for (size_t j = i + 1; j < allCourses.size(); j++) {
+				if (isAlwaysConflicting(allCourses[i], allCourses[j])) {
+					hasPair = true;
+					setColor(12);
+					cout << allCourses[i]->name << " × " << allCourses[j]->name;
+					setColor(7);
+					cout << "（所有教学班时间均冲突）" << endl;
+				}
+			}
+		}
+		if (!hasPair) {
+			setColor(7);
+			cout << "无" << endl;
+		}
+		setColor(7);
+		cout << "\n按任意键返回...";
+		_getch();
+	}
+	
+	// 导出已选课程到 CSV 文件，返回是否成功
+	// 文字按程序编译时的执行字符集原样写出，不加 BOM：默认编译为 UTF-8，
+	// 以 g++ -fexec-charset=GBK（MSVC 为 /execution-charset:gbk）编译时为 GBK
+	bool exportSelections(const string& fileName) const {
+		ofstream out(fileName);
+		if (!out) return false;
+		
+		out << "学期,课程编号,课程名称,学分,教学班,教师,星期,开始时间,结束时间,地点" << '\n';
+		int credits = 0;
+		for (Course* course : allCourses) {
+			const CourseClass* cls = course->getSelectedClass();
+			if (!cls) continue;
+			out << course->semester << ',' << course->id << ',' << csvField(course->name) << ','
+				<< course->credit << ',' << csvField(cls->classId) << ',' << csvField(cls->teacher) << ','
+				<< cls->timeSlot.weekday << ',' << cls->timeSlot.startTime << ','
+				<< cls->timeSlot.endTime << ',' << csvField(cls->timeSlot.location) << '\n';
+			credits += course->credit;
+		}
+		out << ",,总学分," << credits << ",,,,,," << '\n';
+		return static_cast<bool>(out);
+	}
+	
+	// 导出选课结果
+	void exportResult() {
+		system("cls");
+		setColor(11);
+		cout << "==============================================导出选课==============================================" << endl;
+		const string fileName = "course_selection.csv";
+		if (exportSelections(fileName)) {
+			setColor(10);
+			cout << "^-^ 已导出到 " << fileName << endl;
+		} else {
+			setColor(12);
+			cout << "QAQ 导出失败，无法写入 " << fileName << endl;
+		}
+		setColor(7);
+		cout << "\n按任意键返回...";
+		_getch();
+	}
+	
+	// 从文件重新加载教学班，并重新校验受影响的已选课程，返回被更新的课程数，无法读取文件时返回 -1
+	// 文件每行：课程编号,教学班编号,教师,星期,开始时间,结束时间,地点（空行和 # 开头的行忽略），
+	// 编码须与程序编译时的执行字符集一致（见 exportSelections）；格式错误、课程未知、教学班编号或教师为空、
+	// 同一课程教学班编号重复、时间不在课表范围内的行跳过，计入 skippedLines
+	// 文件中出现的课程整体替换其教学班列表，未出现的课程保持不变
+	int reloadCourseClasses(const string& fileName, int& skippedLines) {
+		skippedLines = 0;
+		ifstream in(fileName);
+		if (!in) return -1;
+		
+		unordered_map<string, Course*> idToCourse;
+		for (Course* course : allCourses) {
+			idToCourse[course->id] = course;
+		}
+		
+		// 1、读取新的教学班，按课程分组（保持文件中的顺序）
+		vector<Course*> changed;
+		unordered_map<Course*, vector<CourseClass>> newClasses;
+		unordered_set<string> seenClassKeys;			// 已读取的“课程编号-教学班编号”，用于排除重复
+		string line;
+		while (getline(in, line)) {
+			if (!line.empty() && line.back() == '\r') line.pop_back();
+			if (line.empty() || line[0] == '#') continue;
+			
+			vector<string> fields;
+			stringstream ss(line);
+			string field;
+			while (getline(ss, field, ',')) {
+				fields.push_back(field);
+			}
+			if (fields.size() != 7) {						// 格式错误
+				skippedLines++;
+				continue;
+			}
+			auto it = idToCourse.find(fields[0]);
+			if (it == idToCourse.end()) {					// 未知课程
+				skippedLines++;
+				continue;
+			}
+			if (fields[1].empty() || fields[2].empty() ||	// 教学班编号或教师为空
+				!seenClassKeys.insert(fields[0] + "-" + fields[1]).second) {	// 同一课程教学班编号重复
+				skippedLines++;
+				continue;
+			}
+			TimeSlot timeSlot(fields[3], fields[4], fields[5], fields[6]);
+			if (!timeSlot.isValid() || !fitsTimetable(timeSlot)) {	// 时间无法识别或课表中无法显示
+				skippedLines++;
+				continue;
+			}
+			
+			Course* course = it->second;
+			if (newClasses.find(course) == newClasses.end()) {
+				changed.push_back(course);
+			}
+			newClasses[course].push_back(CourseClass(fields[1], fields[2], move(timeSlot)));
+		}
+		
+		// 2、替换教学班，已选的教学班按编号保留；编号已不存在的退选
+		for (Course* course : changed) {
+			vector<CourseClass>& classes = newClasses[course];
+			const CourseClass* old = course->getSelectedClass();
+			bool kept = false;
+			if (old) {
+				for (auto& cls : classes) {
+					if (cls.classId == old->classId) {
+						cls.selected = true;
+						kept = true;
+						break;
+					}
+				}
+				if (!kept) dropSelectedClass(course, ChangeType::Drop);
+			}
+			course->classes = move(classes);
+		}
+		
+		// 3、先联动退选失去前置条件的课程，再检查时间冲突：避免因与即将被退选的课程冲突而多退。
+		//    只有被更新的课程可能产生新的冲突，每次只退选一门，随后重新联动退选，直到没有冲突
+		while (true) {
+			dropUnsatisfiedCourses();
+			Course* conflicting = nullptr;
+			for (Course* course : changed) {
+				const CourseClass* cls = course->getSelectedClass();
+				if (cls && isTimeConflict(cls->timeSlot, course)) {
+					conflicting = course;
+					break;
+				}
+			}
+			if (!conflicting) break;
+			dropSelectedClass(conflicting, ChangeType::Drop);
+		}
+		
+		return (int)changed.size();
+	}
+	
+	// 更新教学班
+	void reloadCatalog() {
+		system("cls");
+		setColor(11);
+		cout << "==============================================更新教学班==============================================" << endl;
+		const string fileName = "course_classes.txt";
+		size_t logStart = changeLog.size();
+		int skippedLines = 0;
+		int count = reloadCourseClasses(fileName, skippedLines);
+		if (count < 0) {
+			setColor(12);
+			cout << "QAQ 无法读取 " << fileName << endl;
+		} else {
+			setColor(10);
+			cout << "^-^ 已从 " << fileName << " 更新 " << count << " 门课程的教学班" << endl;
+			if (skippedLines > 0) {
+				setColor(14);
+				cout << "已跳过 " << skippedLines << " 行（格式错误、课程未知、教学班编号或教师为空、教学班编号重复、时间不在课表范围内，或文件编码与程序不一致）" << endl;
+			}
+			setColor(12);
+			for (size_t i = logStart; i < changeLog.size(); i++) {
+				const ChangeEvent& e = changeLog[i];
+				const Course* course = findCourseById(e.courseId);
+				cout << (e.type == ChangeType::CascadeDrop ? "@A@ 已退选依赖课程：" : "@A@ 已退选：")
+					 << (course ? course->name : e.courseId) << " - " << e.classId << endl;
+			}
+		}
+		setColor(7);
+		cout << "\n按任意键返回...";
+		_getch();
+	}
+	
+	// 查找选择 rejected 教学班发生时间冲突时的替代方案，按以下顺序返回（组内按教学班顺序）：
+	// 1、本课程中与其他已选课程不冲突的其他教学班（isSwap 为 false）；
+	// 2、若只与一门已选课程冲突，该课程可换到的、能腾出该时间的教学班（isSwap 为 true）。
+	vector<ClassAlternative> findAlternatives(const Course* course, const CourseClass& rejected) const {
+		vector<ClassAlternative> alternatives;
+		for (const auto& cls : course->classes) {
+			if (&cls == &rejected || cls.selected || isTimeConflict(cls.timeSlot, course)) continue;
+			alternatives.emplace_back(course, &cls, false);
+		}
+		
+		vector<Course*> conflicts = findConflictingCourses(rejected.timeSlot, course);
+		if (conflicts.size() == 1) {
+			const Course* other = conflicts[0];
+			for (const auto& cls : other->classes) {
+				// 换班须能在菜单中直接完成：本课程的原教学班此时仍占用时间，一并检查
+				if (cls.selected || cls.timeSlot.isConflict(rejected.timeSlot) ||
+					isTimeConflict(cls.timeSlot, other)) continue;
+				alternatives.emplace_back(other, &cls, true);
+			}
+		}
+		return alternatives;
+	}
+	
+	// 获取选课变更记录（按发生顺序）
+	const vector<ChangeEvent>& getChangeLog() const {
+		return changeLog;
+	}
+	
+	// 显示选课变更记录
+	void displayChangeLog() {
+		system("cls");
+		setColor(11);
+		cout << "==============================================变更记录==============================================" << endl;
+		if (changeLog.empty()) {
+			setColor(7);
+			cout << "暂无变更记录" << endl;
+		}
+		for (size_t i = 0; i < changeLog.size(); i++) {
+			const ChangeEvent& e = changeLog[i];
+			switch (e.type) {
+				case ChangeType::Select:      setColor(10); cout << "[" << i+1 << "] 选课     "; break;
+				case ChangeType::Drop:        setColor(14); cout << "[" << i+1 << "] 退选     "; break;
+				case ChangeType::CascadeDrop: setColor(12); cout << "[" << i+1 << "] 联动退选 "; break;
+			}
+			setColor(7);
+			cout << e.courseId << " | " << e.classId << " | 学分：" << e.credit << endl;
+		}
 		setColor(7);
 		cout << "\n按任意键返回...";
 		_getch();
@@ -542,8 +971,8 @@ public:
 		cout << "==============================================我的课表==============================================" << endl;
 		
 		// 课表基础配置：星期和时间段
-		vector<string> weekdays = {"周一", "周二", "周三", "周四", "周五"};
-		vector<string> timeRanges = {"08:00-09:00", "09:00-10:00", "10:00-11:00", "14:00-15:00", "16:00-17:00"};
+		const vector<string>& weekdays = TIMETABLE_WEEKDAYS;
+		const vector<string>& timeRanges = TIMETABLE_RANGES;
 		
 		// 第一学期
 		setColor(14);
@@ -830,6 +1259,9 @@ int main() {
 				case 'C': courseSystem.checkRequirements(); break;						// 查学分
 				case 'D': courseSystem.displayDependencyGraph(); break;					// 查依赖
 				case 'T': courseSystem.displayTimetable(); break;						// 查课表
+				case 'L': courseSystem.displayChangeLog(); break;						// 查变更记录
+				case 'E': courseSystem.exportResult(); break;							// 导出选课
+				case 'U': courseSystem.reloadCatalog(); break;							// 更新教学班
 				case 'Q': cout << "感谢使用！"; Sleep(1000); isQuit = true; break;		// 退出
 				default: cout << "无效操作！"; Sleep(1500); break;
 			}